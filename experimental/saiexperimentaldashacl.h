@@ -312,6 +312,11 @@ typedef struct _sai_dash_acl_api_t
     sai_get_dash_acl_rule_attribute_fn     get_dash_acl_rule_attribute;
     sai_bulk_object_create_fn              create_dash_acl_rules;
     sai_bulk_object_remove_fn              remove_dash_acl_rules;
+    sai_bulk_object_set_attribute_fn       set_dash_acl_rules_attribute;
+    sai_bulk_object_get_attribute_fn       get_dash_acl_rules_attribute;
+
+    sai_bulk_object_set_attribute_fn       set_dash_acl_groups_attribute;
+    sai_bulk_object_get_attribute_fn       get_dash_acl_groups_attribute;
 
 } sai_dash_acl_api_t;
 
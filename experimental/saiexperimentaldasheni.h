@@ -923,6 +923,53 @@ typedef sai_status_t (*sai_bulk_remove_eni_ether_address_map_entry_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk set attribute on ENI ether address map entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] eni_ether_address_map_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_eni_ether_address_map_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_eni_ether_address_map_entry_t *eni_ether_address_map_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on ENI ether address map entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] eni_ether_address_map_entry List of objects to set attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_eni_ether_address_map_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_eni_ether_address_map_entry_t *eni_ether_address_map_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 /**
  * @brief Create ENI
  *
@@ -1025,22 +1072,25 @@ typedef sai_status_t (*sai_clear_eni_stats_fn)(
 
 typedef struct _sai_dash_eni_api_t
 {
-    sai_create_eni_ether_address_map_entry_fn           create_eni_ether_address_map_entry;
-    sai_remove_eni_ether_address_map_entry_fn           remove_eni_ether_address_map_entry;
-    sai_set_eni_ether_address_map_entry_attribute_fn    set_eni_ether_address_map_entry_attribute;
-    sai_get_eni_ether_address_map_entry_attribute_fn    get_eni_ether_address_map_entry_attribute;
-    sai_bulk_create_eni_ether_address_map_entry_fn      create_eni_ether_address_map_entries;
-    sai_bulk_remove_eni_ether_address_map_entry_fn      remove_eni_ether_address_map_entries;
-
-    sai_create_eni_fn                                   create_eni;
-    sai_remove_eni_fn                                   remove_eni;
-    sai_set_eni_attribute_fn                            set_eni_attribute;
-    sai_get_eni_attribute_fn                            get_eni_attribute;
-    sai_get_eni_stats_fn                                get_eni_stats;
-    sai_get_eni_stats_ext_fn                            get_eni_stats_ext;
-    sai_clear_eni_stats_fn                              clear_eni_stats;
-    sai_bulk_object_create_fn                           create_enis;
-    sai_bulk_object_remove_fn                           remove_enis;
+    sai_create_eni_ether_address_map_entry_fn                create_eni_ether_address_map_entry;
+    sai_remove_eni_ether_address_map_entry_fn                remove_eni_ether_address_map_entry;
+    sai_set_eni_ether_address_map_entry_attribute_fn         set_eni_ether_address_map_entry_attribute;
+    sai_get_eni_ether_address_map_entry_attribute_fn         get_eni_ether_address_map_entry_attribute;
+    sai_bulk_create_eni_ether_address_map_entry_fn           create_eni_ether_address_map_entries;
+    sai_bulk_remove_eni_ether_address_map_entry_fn           remove_eni_ether_address_map_entries;
+
+    sai_create_eni_fn                                        create_eni;
+    sai_remove_eni_fn                                        remove_eni;
+    sai_set_eni_attribute_fn                                 set_eni_attribute;
+    sai_get_eni_attribute_fn                                 get_eni_attribute;
+    sai_get_eni_stats_fn                                     get_eni_stats;
+    sai_get_eni_stats_ext_fn                                 get_eni_stats_ext;
+    sai_clear_eni_stats_fn                                   clear_eni_stats;
+    sai_bulk_object_create_fn                                create_enis;
+    sai_bulk_object_remove_fn                                remove_enis;
+
+    sai_bulk_set_eni_ether_address_map_entry_attribute_fn    set_eni_ether_address_map_entries_attribute;
+    sai_bulk_get_eni_ether_address_map_entry_attribute_fn    get_eni_ether_address_map_entries_attribute;
 
 } sai_dash_eni_api_t;
 
@@ -366,6 +366,53 @@ typedef sai_status_t (*sai_bulk_remove_meter_bucket_entry_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk set attribute on meter bucket entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] meter_bucket_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_meter_bucket_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_meter_bucket_entry_t *meter_bucket_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on meter bucket entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] meter_bucket_entry List of objects to set attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_meter_bucket_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_meter_bucket_entry_t *meter_bucket_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 /**
  * @brief Create meter policy
  *
@@ -472,29 +519,32 @@ typedef sai_status_t (*sai_get_meter_rule_attribute_fn)(
 
 typedef struct _sai_dash_meter_api_t
 {
-    sai_create_meter_bucket_entry_fn           create_meter_bucket_entry;
-    sai_remove_meter_bucket_entry_fn           remove_meter_bucket_entry;
-    sai_set_meter_bucket_entry_attribute_fn    set_meter_bucket_entry_attribute;
-    sai_get_meter_bucket_entry_attribute_fn    get_meter_bucket_entry_attribute;
-    sai_get_meter_bucket_entry_stats_fn        get_meter_bucket_entry_stats;
-    sai_get_meter_bucket_entry_stats_ext_fn    get_meter_bucket_entry_stats_ext;
-    sai_clear_meter_bucket_entry_stats_fn      clear_meter_bucket_entry_stats;
-    sai_bulk_create_meter_bucket_entry_fn      create_meter_bucket_entries;
-    sai_bulk_remove_meter_bucket_entry_fn      remove_meter_bucket_entries;
-
-    sai_create_meter_policy_fn                 create_meter_policy;
-    sai_remove_meter_policy_fn                 remove_meter_policy;
-    sai_set_meter_policy_attribute_fn          set_meter_policy_attribute;
-    sai_get_meter_policy_attribute_fn          get_meter_policy_attribute;
-    sai_bulk_object_create_fn                  create_meter_policys;
-    sai_bulk_object_remove_fn                  remove_meter_policys;
-
-    sai_create_meter_rule_fn                   create_meter_rule;
-    sai_remove_meter_rule_fn                   remove_meter_rule;
-    sai_set_meter_rule_attribute_fn            set_meter_rule_attribute;
-    sai_get_meter_rule_attribute_fn            get_meter_rule_attribute;
-    sai_bulk_object_create_fn                  create_meter_rules;
-    sai_bulk_object_remove_fn                  remove_meter_rules;
+    sai_create_meter_bucket_entry_fn                create_meter_bucket_entry;
+    sai_remove_meter_bucket_entry_fn                remove_meter_bucket_entry;
+    sai_set_meter_bucket_entry_attribute_fn         set_meter_bucket_entry_attribute;
+    sai_get_meter_bucket_entry_attribute_fn         get_meter_bucket_entry_attribute;
+    sai_get_meter_bucket_entry_stats_fn             get_meter_bucket_entry_stats;
+    sai_get_meter_bucket_entry_stats_ext_fn         get_meter_bucket_entry_stats_ext;
+    sai_clear_meter_bucket_entry_stats_fn           clear_meter_bucket_entry_stats;
+    sai_bulk_create_meter_bucket_entry_fn           create_meter_bucket_entries;
+    sai_bulk_remove_meter_bucket_entry_fn           remove_meter_bucket_entries;
+
+    sai_create_meter_policy_fn                      create_meter_policy;
+    sai_remove_meter_policy_fn                      remove_meter_policy;
+    sai_set_meter_policy_attribute_fn               set_meter_policy_attribute;
+    sai_get_meter_policy_attribute_fn               get_meter_policy_attribute;
+    sai_bulk_object_create_fn                       create_meter_policys;
+    sai_bulk_object_remove_fn                       remove_meter_policys;
+
+    sai_create_meter_rule_fn                        create_meter_rule;
+    sai_remove_meter_rule_fn                        remove_meter_rule;
+    sai_set_meter_rule_attribute_fn                 set_meter_rule_attribute;
+    sai_get_meter_rule_attribute_fn                 get_meter_rule_attribute;
+    sai_bulk_object_create_fn                       create_meter_rules;
+    sai_bulk_object_remove_fn                       remove_meter_rules;
+
+    sai_bulk_set_meter_bucket_entry_attribute_fn    set_meter_bucket_entries_attribute;
+    sai_bulk_get_meter_bucket_entry_attribute_fn    get_meter_bucket_entries_attribute;
 
 } sai_dash_meter_api_t;
 
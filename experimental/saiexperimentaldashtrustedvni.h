@@ -55,6 +55,11 @@ typedef enum _sai_eni_trusted_vni_entry_action_t
 
 /**
  * @brief Entry for global_trusted_vni_entry
+ *
+ * Inbound packet VNI is trusted when it falls in the range of any global
+ * trusted VNI entry or any trusted VNI entry of the ENI. Packets whose VNI
+ * is not trusted are dropped and counted by
+ * #SAI_ENI_STAT_ENI_TRUSTED_VNI_ENTRY_MISS_DROP_PACKETS.
  */
 typedef struct _sai_global_trusted_vni_entry_t
 {
@@ -106,6 +111,8 @@ typedef enum _sai_global_trusted_vni_entry_attr_t
 
 /**
  * @brief Entry for eni_trusted_vni_entry
+ *
+ * Extends global trusted VNI entries for a single ENI.
  */
 typedef struct _sai_eni_trusted_vni_entry_t
 {
@@ -257,6 +264,53 @@ typedef sai_status_t (*sai_bulk_remove_global_trusted_vni_entry_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk set attribute on global trusted VNI entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] global_trusted_vni_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_global_trusted_vni_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_global_trusted_vni_entry_t *global_trusted_vni_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on global trusted VNI entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] global_trusted_vni_entry List of objects to set attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_global_trusted_vni_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_global_trusted_vni_entry_t *global_trusted_vni_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 /**
  * @brief Create ENI trusted VNI entry
  *
@@ -352,21 +406,73 @@ typedef sai_status_t (*sai_bulk_remove_eni_trusted_vni_entry_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk set attribute on ENI trusted VNI entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] eni_trusted_vni_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_eni_trusted_vni_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_eni_trusted_vni_entry_t *eni_trusted_vni_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on ENI trusted VNI entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] eni_trusted_vni_entry List of objects to set attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_eni_trusted_vni_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_eni_trusted_vni_entry_t *eni_trusted_vni_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 typedef struct _sai_dash_trusted_vni_api_t
 {
-    sai_create_global_trusted_vni_entry_fn           create_global_trusted_vni_entry;
-    sai_remove_global_trusted_vni_entry_fn           remove_global_trusted_vni_entry;
-    sai_set_global_trusted_vni_entry_attribute_fn    set_global_trusted_vni_entry_attribute;
-    sai_get_global_trusted_vni_entry_attribute_fn    get_global_trusted_vni_entry_attribute;
-    sai_bulk_create_global_trusted_vni_entry_fn      create_global_trusted_vni_entries;
-    sai_bulk_remove_global_trusted_vni_entry_fn      remove_global_trusted_vni_entries;
-
-    sai_create_eni_trusted_vni_entry_fn              create_eni_trusted_vni_entry;
-    sai_remove_eni_trusted_vni_entry_fn              remove_eni_trusted_vni_entry;
-    sai_set_eni_trusted_vni_entry_attribute_fn       set_eni_trusted_vni_entry_attribute;
-    sai_get_eni_trusted_vni_entry_attribute_fn       get_eni_trusted_vni_entry_attribute;
-    sai_bulk_create_eni_trusted_vni_entry_fn         create_eni_trusted_vni_entries;
-    sai_bulk_remove_eni_trusted_vni_entry_fn         remove_eni_trusted_vni_entries;
+    sai_create_global_trusted_vni_entry_fn                create_global_trusted_vni_entry;
+    sai_remove_global_trusted_vni_entry_fn                remove_global_trusted_vni_entry;
+    sai_set_global_trusted_vni_entry_attribute_fn         set_global_trusted_vni_entry_attribute;
+    sai_get_global_trusted_vni_entry_attribute_fn         get_global_trusted_vni_entry_attribute;
+    sai_bulk_create_global_trusted_vni_entry_fn           create_global_trusted_vni_entries;
+    sai_bulk_remove_global_trusted_vni_entry_fn           remove_global_trusted_vni_entries;
+
+    sai_create_eni_trusted_vni_entry_fn                   create_eni_trusted_vni_entry;
+    sai_remove_eni_trusted_vni_entry_fn                   remove_eni_trusted_vni_entry;
+    sai_set_eni_trusted_vni_entry_attribute_fn            set_eni_trusted_vni_entry_attribute;
+    sai_get_eni_trusted_vni_entry_attribute_fn            get_eni_trusted_vni_entry_attribute;
+    sai_bulk_create_eni_trusted_vni_entry_fn              create_eni_trusted_vni_entries;
+    sai_bulk_remove_eni_trusted_vni_entry_fn              remove_eni_trusted_vni_entries;
+    sai_bulk_set_eni_trusted_vni_entry_attribute_fn       set_eni_trusted_vni_entries_attribute;
+    sai_bulk_get_eni_trusted_vni_entry_attribute_fn       get_eni_trusted_vni_entries_attribute;
+
+    sai_bulk_set_global_trusted_vni_entry_attribute_fn    set_global_trusted_vni_entries_attribute;
+    sai_bulk_get_global_trusted_vni_entry_attribute_fn    get_global_trusted_vni_entries_attribute;
 
 } sai_dash_trusted_vni_api_t;
 
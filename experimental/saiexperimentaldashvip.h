@@ -199,14 +199,63 @@ typedef sai_status_t (*sai_bulk_remove_vip_entry_fn)(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+/**
+ * @brief Bulk set attribute on VIP entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] vip_entry List of objects to set attribute
+ * @param[in] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_set_vip_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_vip_entry_t *vip_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+/**
+ * @brief Bulk get attribute on VIP entry
+ *
+ * @param[in] object_count Number of objects to set attribute
+ * @param[in] vip_entry List of objects to set attribute
+ * @param[in] attr_count List of attr_count. Caller passes the number
+ *    of attribute for each object to get
+ * @param[inout] attr_list List of attributes to set on objects, one attribute per object
+ * @param[in] mode Bulk operation error handling mode
+ * @param[out] object_statuses List of status for every object. Caller needs to
+ * allocate the buffer
+ *
+ * @return #SAI_STATUS_SUCCESS on success when all objects are removed or
+ * #SAI_STATUS_FAILURE when any of the objects fails to remove. When there is
+ * failure, Caller is expected to go through the list of returned statuses to
+ * find out which fails and which succeeds.
+ */
+typedef sai_status_t (*sai_bulk_get_vip_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_vip_entry_t *vip_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 typedef struct _sai_dash_vip_api_t
 {
-    sai_create_vip_entry_fn           create_vip_entry;
-    sai_remove_vip_entry_fn           remove_vip_entry;
-    sai_set_vip_entry_attribute_fn    set_vip_entry_attribute;
-    sai_get_vip_entry_attribute_fn    get_vip_entry_attribute;
-    sai_bulk_create_vip_entry_fn      create_vip_entries;
-    sai_bulk_remove_vip_entry_fn      remove_vip_entries;
+    sai_create_vip_entry_fn                create_vip_entry;
+    sai_remove_vip_entry_fn                remove_vip_entry;
+    sai_set_vip_entry_attribute_fn         set_vip_entry_attribute;
+    sai_get_vip_entry_attribute_fn         get_vip_entry_attribute;
+    sai_bulk_create_vip_entry_fn           create_vip_entries;
+    sai_bulk_remove_vip_entry_fn           remove_vip_entries;
+    sai_bulk_set_vip_entry_attribute_fn    set_vip_entries_attribute;
+    sai_bulk_get_vip_entry_attribute_fn    get_vip_entries_attribute;
 
 } sai_dash_vip_api_t;
 
@@ -681,6 +681,11 @@ typedef sai_status_t (*sai_clear_bfd_session_stats_fn)(
  *
  * Passed as a parameter into sai_initialize_switch()
  *
+ * Several state changes, for example after a link flap, may be reported in
+ * one notification. Entries are in the order in which changes happened, so
+ * when the same session appears more than once, the last entry holds its
+ * current state.
+ *
  * @count data[count]
  *
  * @param[in] count Number of notifications
@@ -702,6 +707,10 @@ typedef struct _sai_bfd_api_t
     sai_get_bfd_session_stats_fn         get_bfd_session_stats;
     sai_get_bfd_session_stats_ext_fn     get_bfd_session_stats_ext;
     sai_clear_bfd_session_stats_fn       clear_bfd_session_stats;
+    sai_bulk_object_create_fn            create_bfd_sessions;
+    sai_bulk_object_remove_fn            remove_bfd_sessions;
+    sai_bulk_object_set_attribute_fn     set_bfd_sessions_attribute;
+    sai_bulk_object_get_attribute_fn     get_bfd_sessions_attribute;
 
 } sai_bfd_api_t;
 
@@ -343,6 +343,20 @@ typedef enum _sai_dtel_int_session_attr_t
      */
     SAI_DTEL_INT_SESSION_ATTR_COLLECT_QUEUE_INFO,
 
+    /**
+     * @brief Collect hop latency
+     *
+     * @warning experimental
+     *
+     * Hop latency is the time in nanoseconds the packet spent in this
+     * switch, from ingress to egress.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    SAI_DTEL_INT_SESSION_ATTR_COLLECT_HOP_LATENCY,
+
     /**
      * @brief End of attributes
      */
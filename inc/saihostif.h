@@ -1327,6 +1327,20 @@ typedef enum _sai_hostif_packet_attr_t
      */
     SAI_HOSTIF_PACKET_ATTR_ZERO_COPY_TX,
 
+    /**
+     * @brief Sample rate (for receive-only)
+     *
+     * For packets trapped by a samplepacket session, the
+     * SAI_SAMPLEPACKET_ATTR_SAMPLE_RATE value in effect when the packet
+     * was sampled. Allows the receiver to scale packet counts without
+     * looking up the samplepacket session bound to the ingress or egress
+     * port. Zero if the packet was not sampled.
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_HOSTIF_PACKET_ATTR_SAMPLE_RATE,
+
     /**
      * @brief End of attributes
      */
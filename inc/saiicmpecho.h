@@ -401,6 +401,10 @@ typedef struct _sai_icmp_echo_api_t
     sai_get_icmp_echo_session_stats_fn         get_icmp_echo_session_stats;
     sai_get_icmp_echo_session_stats_ext_fn     get_icmp_echo_session_stats_ext;
     sai_clear_icmp_echo_session_stats_fn       clear_icmp_echo_session_stats;
+    sai_bulk_object_create_fn                  create_icmp_echo_sessions;
+    sai_bulk_object_remove_fn                  remove_icmp_echo_sessions;
+    sai_bulk_object_set_attribute_fn           set_icmp_echo_sessions_attribute;
+    sai_bulk_object_get_attribute_fn           get_icmp_echo_sessions_attribute;
 
 } sai_icmp_echo_api_t;
 
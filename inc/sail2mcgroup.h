@@ -238,6 +238,8 @@ typedef struct _sai_l2mc_group_api_t
     sai_remove_l2mc_group_member_fn            remove_l2mc_group_member;
     sai_set_l2mc_group_member_attribute_fn     set_l2mc_group_member_attribute;
     sai_get_l2mc_group_member_attribute_fn     get_l2mc_group_member_attribute;
+    sai_bulk_object_create_fn                  create_l2mc_group_members;
+    sai_bulk_object_remove_fn                  remove_l2mc_group_members;
 
 } sai_l2mc_group_api_t;
 
@@ -413,6 +413,8 @@ typedef struct _sai_lag_api_t
     sai_get_lag_member_attribute_fn  get_lag_member_attribute;
     sai_bulk_object_create_fn        create_lag_members;
     sai_bulk_object_remove_fn        remove_lag_members;
+    sai_bulk_object_set_attribute_fn set_lag_members_attribute;
+    sai_bulk_object_get_attribute_fn get_lag_members_attribute;
 } sai_lag_api_t;
 
 /**
@@ -1550,6 +1550,14 @@ typedef struct _sai_macsec_api_t
     sai_get_macsec_sa_stats_fn          get_macsec_sa_stats;
     sai_get_macsec_sa_stats_ext_fn      get_macsec_sa_stats_ext;
     sai_clear_macsec_sa_stats_fn        clear_macsec_sa_stats;
+    sai_bulk_object_create_fn           create_macsec_scs;
+    sai_bulk_object_remove_fn           remove_macsec_scs;
+    sai_bulk_object_set_attribute_fn    set_macsec_scs_attribute;
+    sai_bulk_object_get_attribute_fn    get_macsec_scs_attribute;
+    sai_bulk_object_create_fn           create_macsec_sas;
+    sai_bulk_object_remove_fn           remove_macsec_sas;
+    sai_bulk_object_set_attribute_fn    set_macsec_sas_attribute;
+    sai_bulk_object_get_attribute_fn    get_macsec_sas_attribute;
 } sai_macsec_api_t;
 
 /**
@@ -194,6 +194,10 @@ typedef enum _sai_nat_entry_attr_t
     /**
      * @brief NAT entry hit bit clear on read flag
      *
+     * When true, every read of #SAI_NAT_ENTRY_ATTR_HIT_BIT, including reads
+     * through get_nat_entries_attribute, returns the hit bit and clears it
+     * atomically, so no hit between the read and the clear is lost.
+     *
      * @type bool
      * @flags CREATE_AND_SET
      * @default false
@@ -203,6 +207,8 @@ typedef enum _sai_nat_entry_attr_t
     /**
      * @brief Per NAT entry hit bit state
      *
+     * Cleared on read when #SAI_NAT_ENTRY_ATTR_HIT_BIT_COR is true.
+     *
      * @type bool
      * @flags CREATE_AND_SET
      * @default false
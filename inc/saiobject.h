@@ -328,6 +328,11 @@ sai_status_t sai_query_stats_st_capability(
 /**
  * @brief Bulk objects get statistics.
  *
+ * Object key is object id for object types with object id, and the entry
+ * structure for other object types, for example meter bucket entry. Support
+ * for each statistic is reported by sai_query_stats_capability() with
+ * #SAI_STATS_MODE_BULK_READ or #SAI_STATS_MODE_BULK_READ_AND_CLEAR mode bit.
+ *
  * @param[in] switch_id SAI Switch object id
  * @param[in] object_type Object type
  * @param[in] object_count Number of objects to get the stats
@@ -356,6 +361,10 @@ sai_status_t sai_bulk_object_get_stats(
 /**
  * @brief Bulk objects clear statistics.
  *
+ * Object key is used as in sai_bulk_object_get_stats(). Support for each
+ * statistic is reported by sai_query_stats_capability() with
+ * #SAI_STATS_MODE_BULK_CLEAR mode bit.
+ *
  * @param[in] switch_id SAI Switch object id
  * @param[in] object_type Object type
  * @param[in] object_count Number of objects to get the stats
@@ -51,6 +51,27 @@ typedef enum _sai_meter_type_t
 
 /**
  * @brief Enum defining mode of the policer object
+ *
+ * All modes use token buckets that are filled at the configured rate up to
+ * the configured burst size, counted in bytes or packets based on
+ * #SAI_POLICER_ATTR_METER_TYPE. Both buckets start full.
+ *
+ * In SR_TCM mode the committed bucket (CBS) is filled at CIR and tokens that
+ * overflow it fill the excess bucket (PBS). A packet is green if the
+ * committed bucket has enough tokens, else yellow if the excess bucket has
+ * enough tokens, else red.
+ *
+ * In TR_TCM mode the committed bucket (CBS) is filled at CIR and the peak
+ * bucket (PBS) is filled at PIR. A packet is red if the peak bucket does not
+ * have enough tokens, else yellow if the committed bucket does not have
+ * enough tokens, else green.
+ *
+ * In STORM_CONTROL mode only the committed bucket (CBS) filled at CIR is
+ * used. A packet is green if the bucket has enough tokens, else red.
+ *
+ * Tokens are taken only from the buckets that the resulting color consumes
+ * as defined in the referenced RFC. In color aware mode a packet is never
+ * marked with a better color than the one it arrived with.
  */
 typedef enum _sai_policer_mode_t
 {
@@ -399,6 +420,10 @@ typedef struct _sai_policer_api_t
     sai_get_policer_stats_fn              get_policer_stats;
     sai_get_policer_stats_ext_fn          get_policer_stats_ext;
     sai_clear_policer_stats_fn            clear_policer_stats;
+    sai_bulk_object_create_fn             create_policers;
+    sai_bulk_object_remove_fn             remove_policers;
+    sai_bulk_object_set_attribute_fn      set_policers_attribute;
+    sai_bulk_object_get_attribute_fn      get_policers_attribute;
 
 } sai_policer_api_t;
 
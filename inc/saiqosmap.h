@@ -114,6 +114,10 @@ typedef enum _sai_qos_map_attr_t
      * - All Dot1p/DSCP maps to color #SAI_PACKET_COLOR_GREEN
      * - All traffic class maps to queue 0
      *
+     * Key fields are selected by map type and each key may appear only once
+     * in the list. Implementation should reject a list with duplicated keys
+     * with #SAI_STATUS_INVALID_PARAMETER.
+     *
      * @type sai_qos_map_list_t
      * @flags MANDATORY_ON_CREATE | CREATE_AND_SET
      */
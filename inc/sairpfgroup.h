@@ -228,6 +228,8 @@ typedef struct _sai_rpf_group_api_t
     sai_remove_rpf_group_member_fn             remove_rpf_group_member;
     sai_set_rpf_group_member_attribute_fn      set_rpf_group_member_attribute;
     sai_get_rpf_group_member_attribute_fn      get_rpf_group_member_attribute;
+    sai_bulk_object_create_fn                  create_rpf_group_members;
+    sai_bulk_object_remove_fn                  remove_rpf_group_members;
 
 } sai_rpf_group_api_t;
 
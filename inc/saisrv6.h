@@ -671,6 +671,9 @@ typedef struct _sai_srv6_api_t
     sai_bulk_set_my_sid_entry_attribute_fn set_my_sid_entries_attribute;
     sai_bulk_get_my_sid_entry_attribute_fn get_my_sid_entries_attribute;
 
+    sai_bulk_object_set_attribute_fn       set_srv6_sidlists_attribute;
+    sai_bulk_object_get_attribute_fn       get_srv6_sidlists_attribute;
+
 } sai_srv6_api_t;
 
 /**
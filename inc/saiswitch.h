@@ -184,6 +184,11 @@ typedef enum _sai_switch_switching_mode_t
 /**
  * @brief Attribute data for #SAI_SWITCH_ATTR_ECMP_DEFAULT_HASH_ALGORITHM
  * and #SAI_SWITCH_ATTR_LAG_DEFAULT_HASH_ALGORITHM
+ *
+ * For #SAI_HASH_ALGORITHM_CRC, #SAI_HASH_ALGORITHM_XOR and
+ * #SAI_HASH_ALGORITHM_CRC_XOR the polynomial is implementation specific.
+ * For all algorithms, the order of hash fields in the key and the way the
+ * seed is mixed in are implementation specific.
  */
 typedef enum _sai_hash_algorithm_t
 {
@@ -3432,6 +3437,36 @@ typedef enum _sai_switch_attr_t
      */
     SAI_SWITCH_ATTR_ACL_USER_META_DATA_RANGE_2,
 
+    /**
+     * @brief Maximum number of drop reasons in a single debug counter
+     *
+     * Applies to both in and out drop reason lists. Zero means that the
+     * number of drop reasons per debug counter is not limited.
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_MAX_DEBUG_COUNTER_DROP_REASONS,
+
+    /**
+     * @brief Range of MPLS labels usable as in segment entry label
+     *
+     * Only labels in this range can be used as the label of an in segment
+     * entry.
+     *
+     * @type sai_u32_range_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_INSEG_ENTRY_LABEL_RANGE,
+
+    /**
+     * @brief Available in segment entries
+     *
+     * @type sai_uint32_t
+     * @flags READ_ONLY
+     */
+    SAI_SWITCH_ATTR_AVAILABLE_INSEG_ENTRY,
+
     /**
      * @brief End of attributes
      */
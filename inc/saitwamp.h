@@ -821,6 +821,10 @@ typedef struct _sai_twamp_api_t
     sai_get_twamp_session_stats_fn         get_twamp_session_stats;
     sai_get_twamp_session_stats_ext_fn     get_twamp_session_stats_ext;
     sai_clear_twamp_session_stats_fn       clear_twamp_session_stats;
+    sai_bulk_object_create_fn              create_twamp_sessions;
+    sai_bulk_object_remove_fn              remove_twamp_sessions;
+    sai_bulk_object_set_attribute_fn       set_twamp_sessions_attribute;
+    sai_bulk_object_get_attribute_fn       get_twamp_sessions_attribute;
 
 } sai_twamp_api_t;
 
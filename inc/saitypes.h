@@ -1828,6 +1828,10 @@ typedef enum _sai_stats_mode_t
 
     /**
      * @brief Read and clear after reading
+     *
+     * Read and clear must be atomic with respect to counter updates, so
+     * no update between the read and the clear is lost. For watermark
+     * statistics, clear resets the watermark to the current occupancy.
      */
     SAI_STATS_MODE_READ_AND_CLEAR = 1 << 1,
 
@@ -1843,6 +1847,9 @@ typedef enum _sai_stats_mode_t
 
     /**
      * @brief Bulk read and clear after reading
+     *
+     * Same semantics as #SAI_STATS_MODE_READ_AND_CLEAR applied to every
+     * object in the bulk request.
      */
     SAI_STATS_MODE_BULK_READ_AND_CLEAR = 1 << 4,
 } sai_stats_mode_t;
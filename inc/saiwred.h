@@ -66,6 +66,33 @@ typedef enum _sai_ecn_mark_mode_t
 
 /**
  * @brief Enum defining WRED profile attributes
+ *
+ * Drop curve: applies to non-ECT packets of a color whose drop is enabled
+ * (for example #SAI_WRED_ATTR_GREEN_ENABLE). Packets are not dropped while
+ * the average queue size is below the color minimum threshold. Between the
+ * minimum and maximum thresholds the drop probability grows linearly from 0
+ * up to the color drop probability (for example
+ * #SAI_WRED_ATTR_GREEN_DROP_PROBABILITY). At or above the maximum threshold
+ * all non-ECT packets of that color are dropped.
+ *
+ * Mark curve: applies to ECT packets of a color enabled by
+ * #SAI_WRED_ATTR_ECN_MARK_MODE. ECT packets are marked instead of dropped,
+ * following the same linear shape. When
+ * #SAI_SWITCH_ATTR_ECN_ECT_THRESHOLD_ENABLE is true, the curve uses the color
+ * ECN minimum and maximum thresholds and mark probability (for example
+ * #SAI_WRED_ATTR_ECN_GREEN_MIN_THRESHOLD,
+ * #SAI_WRED_ATTR_ECN_GREEN_MAX_THRESHOLD and
+ * #SAI_WRED_ATTR_ECN_GREEN_MARK_PROBABILITY), and each of them that is absent
+ * falls back to the color drop threshold or drop probability. Otherwise the
+ * curve uses the color drop thresholds and drop probability. With
+ * #SAI_ECN_MARK_MODE_ALL and ECT thresholds enabled, the color unaware ECN
+ * attributes, when set, are used for ECT packets of any color instead of
+ * the per color ones. At or above the maximum threshold all ECT packets of
+ * that color are marked; WRED does not drop them, and they are only dropped
+ * when the queue runs out of buffer. ECT packets of a color not enabled by
+ * the mark mode follow the drop curve.
+ *
+ * The average queue size is computed as described for #SAI_WRED_ATTR_WEIGHT.
  */
 typedef enum _sai_wred_attr_t
 {
@@ -210,6 +237,11 @@ typedef enum _sai_wred_attr_t
     /**
      * @brief Weight 0 ~ 15
      *
+     * Exponential weight used to compute average queue size. On each update
+     * average = average + (current - average) / 2 ^ weight, so weight 0 means
+     * the current queue size is used directly and larger values make the
+     * average follow the current queue size more slowly.
+     *
      * @type sai_uint8_t
      * @flags CREATE_AND_SET
      * @default 0
@@ -3723,6 +3723,8 @@ sub ProcessGenericQuadBulkApi
 
             my $f = ($name =~ /set|get/) ? "${name}_${small}s_attribute" : "${name}_${small}s";
 
+            $f =~ s/entrys/entries/;
+
             my $p = ($name eq "create") ? "switch_id, object_count, attr_count, attr_list, mode, objects, object_statuses" : $params;
 
             WriteSource "status = (apis->${api}_api && apis->${api}_api->${f})";
@@ -4418,6 +4420,7 @@ sub ExtractObjectTypeBulkMap
     my @merged = (@headers, @exheaders, @cuheaders);
 
     my %otmap = ();
+    my %dashmap = ();
 
     for my $header (@merged)
     {
@@ -4438,6 +4441,8 @@ sub ExtractObjectTypeBulkMap
             {
                 $name = $1;
                 $ot = $2;
+
+                $ot =~ s/entrie$/entry/;
             }
             elsif ($fn =~ /^sai_bulk_(create|remove|set|get)_(\w+?)(?:_attribute)?_fn\s+(?:create|remove|set|get)_\w+?s(?:_attribute)?$/)
             {
@@ -4459,6 +4464,21 @@ sub ExtractObjectTypeBulkMap
             }
 
             $otmap{$OT}{$name} = 1;
+
+            $dashmap{$OT} = 1 if $header =~ /^saiexperimentaldash/ and not $fn =~ /^sai_bulk_object_/;
+        }
+    }
+
+    # DASH non object id entries are updated in large batches, so they
+    # must provide full bulk API, like route entry
+
+    for my $OT (sort keys %dashmap)
+    {
+        for my $name (qw/create remove set get/)
+        {
+            next if defined $otmap{$OT}{$name};
+
+            LogError "DASH entry $OT is missing bulk $name API";
         }
     }
 
@@ -610,6 +610,72 @@ bool sai_metadata_is_validonly_met(
     return false;
 }
 
+static bool sai_metadata_qos_map_keys_equal(
+        _In_ sai_qos_map_type_t map_type,
+        _In_ const sai_qos_map_params_t *a,
+        _In_ const sai_qos_map_params_t *b)
+{
+    switch (map_type)
+    {
+        case SAI_QOS_MAP_TYPE_DOT1P_TO_TC:
+        case SAI_QOS_MAP_TYPE_DOT1P_TO_COLOR:
+            return a->dot1p == b->dot1p;
+
+        case SAI_QOS_MAP_TYPE_DSCP_TO_TC:
+        case SAI_QOS_MAP_TYPE_DSCP_TO_COLOR:
+        case SAI_QOS_MAP_TYPE_DSCP_TO_FORWARDING_CLASS:
+            return a->dscp == b->dscp;
+
+        case SAI_QOS_MAP_TYPE_TC_TO_QUEUE:
+        case SAI_QOS_MAP_TYPE_TC_TO_PRIORITY_GROUP:
+            return a->tc == b->tc;
+
+        case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP:
+        case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DOT1P:
+        case SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_MPLS_EXP:
+            return a->tc == b->tc && a->color == b->color;
+
+        case SAI_QOS_MAP_TYPE_PFC_PRIORITY_TO_PRIORITY_GROUP:
+        case SAI_QOS_MAP_TYPE_PFC_PRIORITY_TO_QUEUE:
+            return a->prio == b->prio;
+
+        case SAI_QOS_MAP_TYPE_MPLS_EXP_TO_TC:
+        case SAI_QOS_MAP_TYPE_MPLS_EXP_TO_COLOR:
+        case SAI_QOS_MAP_TYPE_MPLS_EXP_TO_FORWARDING_CLASS:
+            return a->mpls_exp == b->mpls_exp;
+
+        default:
+            return false;
+    }
+}
+
+bool sai_metadata_qos_map_list_has_duplicated_keys(
+        _In_ sai_qos_map_type_t map_type,
+        _In_ const sai_qos_map_list_t *map_list)
+{
+    if (map_list == NULL || map_list->list == NULL)
+    {
+        return false;
+    }
+
+    uint32_t i = 0;
+
+    for (; i < map_list->count; i++)
+    {
+        uint32_t j = i + 1;
+
+        for (; j < map_list->count; j++)
+        {
+            if (sai_metadata_qos_map_keys_equal(map_type, &map_list->list[i].key, &map_list->list[j].key))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 sai_api_version_t sai_metadata_query_api_version(void)
 {
     return SAI_API_VERSION;
@@ -222,6 +222,25 @@ extern bool sai_metadata_is_validonly_met(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list);
 
+/**
+ * @brief Check whether QOS map list contains duplicated keys.
+ *
+ * Key fields compared are selected by map type, for example only DSCP field
+ * is compared for #SAI_QOS_MAP_TYPE_DSCP_TO_TC and TC and color fields are
+ * compared for #SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP. Two entries with the
+ * same key are reported regardless of their values, since both duplicated
+ * and conflicting entries make map ambiguous.
+ *
+ * @param[in] map_type QOS map type.
+ * @param[in] map_list QOS map list to check.
+ *
+ * @return True if at least two entries share the same key, false otherwise.
+ * False will be also returned if map list is NULL or map type is not known.
+ */
+extern bool sai_metadata_qos_map_list_has_duplicated_keys(
+        _In_ sai_qos_map_type_t map_type,
+        _In_ const sai_qos_map_list_t *map_list);
+
 /**
  * @brief Metadata query API version.
  *
@@ -6374,6 +6374,71 @@ void check_object_type_index()
     }
 }
 
+void check_qos_map_list_duplicated_keys()
+{
+    META_LOG_ENTER();
+
+    sai_qos_map_t maps[3];
+
+    memset(maps, 0, sizeof(maps));
+
+    sai_qos_map_list_t list;
+
+    list.count = 3;
+    list.list = maps;
+
+    maps[0].key.dscp = 1;
+    maps[1].key.dscp = 2;
+    maps[2].key.dscp = 3;
+
+    /* TC is shared by first two keys, but it is not key field for DSCP map */
+
+    maps[0].key.tc = 1;
+    maps[1].key.tc = 1;
+
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_DSCP_TO_TC, NULL), "NULL list has no duplicates");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_DSCP_TO_TC, &list), "dscp keys are unique");
+    META_ASSERT_TRUE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_TC_TO_QUEUE, &list), "tc keys are duplicated");
+
+    maps[1].key.color = SAI_PACKET_COLOR_RED;
+
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_TC_AND_COLOR_TO_DSCP, &list), "tc and color keys are unique");
+
+    maps[2].key.dscp = 1;
+
+    META_ASSERT_TRUE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_DSCP_TO_TC, &list), "dscp keys are duplicated");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_CUSTOM_RANGE_BASE, &list), "custom map type is not checked");
+
+    memset(maps, 0, sizeof(maps));
+
+    uint32_t i = 0;
+
+    for (; i < list.count; i++)
+    {
+        maps[i].key.dot1p = (sai_uint8_t)i;
+        maps[i].key.prio = (sai_uint8_t)i;
+        maps[i].key.mpls_exp = (sai_uint8_t)i;
+    }
+
+    maps[2].key.dot1p = 0;
+
+    META_ASSERT_TRUE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_DOT1P_TO_TC, &list), "dot1p keys are duplicated");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_PFC_PRIORITY_TO_QUEUE, &list), "prio keys are unique");
+
+    maps[2].key.dot1p = 2;
+    maps[2].key.prio = 0;
+
+    META_ASSERT_TRUE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_PFC_PRIORITY_TO_QUEUE, &list), "prio keys are duplicated");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_DOT1P_TO_TC, &list), "dot1p keys are unique");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_MPLS_EXP_TO_TC, &list), "mpls_exp keys are unique");
+
+    maps[2].key.prio = 2;
+    maps[2].key.mpls_exp = 0;
+
+    META_ASSERT_TRUE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_MPLS_EXP_TO_TC, &list), "mpls_exp keys are duplicated");
+    META_ASSERT_FALSE(sai_metadata_qos_map_list_has_duplicated_keys(SAI_QOS_MAP_TYPE_PFC_PRIORITY_TO_QUEUE, &list), "prio keys are unique");
+}
+
 int main(int argc, char **argv)
 {
     debug = (argc > 1);
@@ -6425,6 +6490,7 @@ int main(int argc, char **argv)
     check_custom_range_attributes();
     check_attr_get_outside_range();
     check_api_extensions();
+    check_qos_map_list_duplicated_keys();
 
     SAI_META_LOG_DEBUG("log test");
 